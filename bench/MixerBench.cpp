@@ -0,0 +1,60 @@
+// Mide el costo de CPU del bus de mezcla según la cantidad de motores.
+// No abre ningún dispositivo de audio: llama a MixBus::mix directamente.
+// Uso: MixerBench [bloques por medición]
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <vector>
+#include "MixBus.hpp"
+
+int main(int argc, char* argv[]) {
+    const std::size_t frames = 4096;
+    const double sampleRate = 44100.0;
+    const double blockBudgetUs = frames / sampleRate * 1e6; // Tiempo real de un bloque
+    int blocks = (argc > 1) ? std::atoi(argv[1]) : 200;
+    if (blocks <= 0) blocks = 200;
+
+    std::vector<std::int16_t> out(frames * 2);
+    const int engineCounts[] = { 1, 2, 4, 8, 16, 32, 64 };
+
+    std::cout << std::fixed << std::setprecision(2);
+    std::cout << "motores  us/bloque  us/motor  %tiempo-real" << std::endl;
+
+    double previousUs = 0.0;
+    int previousCount = 0;
+    for (int count : engineCounts) {
+        std::vector<std::unique_ptr<EngineSound>> engines;
+        MixBus bus;
+        for (int i = 0; i < count; ++i) {
+            engines.emplace_back(new EngineSound());
+            // RPM repartidas para que haya voces de todos los largos
+            float rpm = 800.f + (6000.f * i) / count;
+            for (int k = 0; k < 50; ++k) engines.back()->setRPM(rpm);
+            engines.back()->setVolume(0.5f);
+            bus.addSource(*engines.back(), 1.f / count, (count > 1) ? -1.f + 2.f * i / (count - 1) : 0.f);
+        }
+
+        // Calentamiento: construye la tabla de impulsos y llena las voces
+        for (int b = 0; b < 10; ++b) bus.mix(&out[0], frames);
+
+        auto start = std::chrono::steady_clock::now();
+        for (int b = 0; b < blocks; ++b) bus.mix(&out[0], frames);
+        auto end = std::chrono::steady_clock::now();
+
+        double us = std::chrono::duration<double, std::micro>(end - start).count() / blocks;
+        std::cout << std::setw(7) << count
+                  << std::setw(11) << us
+                  << std::setw(10) << us / count
+                  << std::setw(13) << 100.0 * us / blockBudgetUs << std::endl;
+
+        if (previousCount > 0) {
+            std::cout << "         +" << (us - previousUs) / (count - previousCount)
+                      << " us por motor adicional" << std::endl;
+        }
+        previousUs = us;
+        previousCount = count;
+    }
+    return 0;
+}
@@ -0,0 +1,18 @@
+# Convierte un archivo binario en un .cpp con un array de bytes.
+# Uso: cmake -DINPUT=<archivo> -DOUTPUT=<salida.cpp> -DSYMBOL=<nombre> -P EmbedResource.cmake
+
+file(READ "${INPUT}" hex HEX)
+file(SIZE "${INPUT}" size)
+
+# Un byte por cada par hexadecimal, 16 bytes por linea
+string(REGEX REPLACE "([0-9a-f][0-9a-f])" "0x\\1," bytes "${hex}")
+string(REPEAT "0x..," 16 line_pattern)
+string(REGEX REPLACE "(${line_pattern})" "\\1\n    " bytes "${bytes}")
+
+file(WRITE "${OUTPUT}"
+"// Generado automaticamente desde ${INPUT}. No editar.\n"
+"#include \"Resources.hpp\"\n\n"
+"namespace Resources {\n"
+"const unsigned char ${SYMBOL}_data[] = {\n    ${bytes}\n};\n"
+"const std::size_t ${SYMBOL}_size = ${size};\n"
+"}\n")
@@ -0,0 +1,32 @@
+#pragma once
+#include <SFML/Audio.hpp>
+#include <vector>
+#include "MixBus.hpp"
+
+// Un solo stream de salida (un hilo de audio) para todos los motores.
+// Las fuentes se conectan con bus().addSource(...).
+class AudioMixer : public sf::SoundStream {
+public:
+    AudioMixer() : samples(framesToStream * 2) {
+        initialize(2, 44100);
+    }
+
+    MixBus& bus() { return mixBus; }
+
+private:
+    static const int framesToStream = 4096;
+
+    MixBus mixBus;
+    std::vector<sf::Int16> samples;
+
+protected:
+    virtual bool onGetData(Chunk& data) {
+        mixBus.mix(&samples[0], framesToStream);
+
+        data.samples = &samples[0];
+        data.sampleCount = samples.size();
+        return true;
+    }
+
+    virtual void onSeek(sf::Time timeOffset) {}
+};
@@ -0,0 +1,171 @@
+#pragma once
+#include <atomic>
+#include <vector>
+#include <cmath>
+#include <algorithm>
+#include <cstddef>
+#include <cstdlib>
+#include "ImpulseCache.hpp"
+#include "MixKernels.hpp"
+
+// Síntesis del sonido de un motor basada en Impulsos Asíncronos (Jitter) y
+// Ruido Marrón. No depende de SFML: genera bloques de muestras float
+// (nominal +/-1, antes del limitador) que mezcla un AudioMixer compartido.
+// setRPM/setVolume se llaman desde el hilo principal y render desde el hilo
+// de audio, por eso esos dos valores son atómicos.
+class EngineSound {
+public:
+    static const int MAX_VOICES = 32;
+
+    EngineSound(float sampleRate = 44100.f)
+        : cache(sharedCache()), sampleRate(sampleRate), currentRPM(0.f),
+          targetVolume(1.0f), samplesUntilNextFire(0) {
+        // Pre-calentamos el buffer de voces
+        // Cada voz es solo una lectura de tabla, así que sobra polifonía
+        voices.resize(MAX_VOICES);
+    }
+
+    void setRPM(float rpm) {
+        // Suavizado para que el sonido no "patine" al acelerar
+        // (solo el hilo principal escribe, así que leer y luego guardar alcanza)
+        float smoothed = currentRPM.load(std::memory_order_relaxed) * 0.9f + rpm * 0.1f;
+        if (smoothed < 0.f) smoothed = 0.f;
+        currentRPM.store(smoothed, std::memory_order_relaxed);
+    }
+
+    void setVolume(float vol) {
+        targetVolume.store(vol, std::memory_order_relaxed);
+    }
+
+    // Sin volumen no hay nada que sintetizar (motor apagado)
+    bool isSilent() const {
+        return targetVolume.load(std::memory_order_relaxed) <= 0.f;
+    }
+
+    void render(float* out, std::size_t count) {
+        std::fill(out, out + count, 0.f);
+
+        // Valores fijos durante todo el bloque
+        const float volume = targetVolume.load(std::memory_order_relaxed);
+        const float rpm = currentRPM.load(std::memory_order_relaxed);
+
+        // Camino rápido: silencio sin correr el secuenciador ni las voces
+        if (volume <= 0.f) {
+            for (auto& v : voices) v.active = false;
+            return;
+        }
+
+        // Las voces que vienen sonando del bloque anterior arrancan en 0
+        for (auto& v : voices) {
+            if (v.active) renderVoice(v, volume, out, 0, count);
+        }
+
+        // --- 1. SECUENCIADOR CON JITTER (Anti-Robótico) ---
+        // En lugar de usar un timer flotante perfecto, contamos muestras.
+        // Se salta directo a la muestra de la próxima explosión.
+        std::size_t i = 0;
+        while (i < count) {
+            std::size_t remaining = count - i;
+            if (samplesUntilNextFire > static_cast<int>(remaining)) {
+                samplesUntilNextFire -= static_cast<int>(remaining);
+                break;
+            }
+            if (samplesUntilNextFire > 1) i += samplesUntilNextFire - 1;
+
+            // Calcular cuándo ocurre la PRÓXIMA explosión
+            float fireFreq = (rpm / 120.f); 
+            if (fireFreq < 1.0f) fireFreq = 1.0f;
+            
+            // Base: muestras por ciclo
+            float samplesPerCycle = sampleRate / fireFreq;
+
+            // JITTER: Variación aleatoria del +/- 10% en el tiempo de detonación
+            // Esto rompe la perfección matemática que suena a "robot".
+            float jitter = 1.0f + ((std::rand() % 200) / 1000.f - 0.1f); 
+            
+            samplesUntilNextFire = static_cast<int>(samplesPerCycle * jitter);
+
+            // --- 2. MEZCLA DE VOCES (Anti-Lata) ---
+            renderVoice(triggerExplosion(rpm), volume, out, i, count);
+            ++i;
+        }
+    }
+
+private:
+    // Estructura para una única explosión individual.
+    // Reproduce dos impulsos cacheados (tramos de RPM vecinos) mezclados.
+    struct Voice {
+        bool active = false;
+        std::size_t position = 0;
+        const std::vector<float>* low = nullptr;  // Tramo inferior
+        const std::vector<float>* high = nullptr; // Tramo superior
+        float gainLow = 0.f;
+        float gainHigh = 0.f;
+    };
+
+    // Una sola tabla para todos los motores (se construye al primer uso)
+    static const ImpulseCache& sharedCache() {
+        static const ImpulseCache instance;
+        return instance;
+    }
+
+    // Suma la voz a out[from, to). Sub-bajo + ruido marrón ya vienen
+    // sintetizados en la tabla (ver ImpulseCache): aquí solo se escalan y
+    // mezclan los dos tramos. El inferior es siempre el más largo.
+    void renderVoice(Voice& v, float volume, float* out, std::size_t from, std::size_t to) {
+        const std::vector<float>& low = *v.low;
+        const std::vector<float>& high = *v.high;
+
+        std::size_t lowCount = std::min(to - from, low.size() - v.position);
+        std::size_t highCount = (v.position < high.size())
+                              ? std::min(lowCount, high.size() - v.position) : 0;
+
+        MixKernels::accumulate(&low[v.position], v.gainLow * volume, out + from, lowCount);
+        if (highCount > 0) {
+            MixKernels::accumulate(&high[v.position], v.gainHigh * volume, out + from, highCount);
+        }
+
+        v.position += lowCount;
+        if (v.position >= low.size()) v.active = false;
+    }
+
+    Voice& triggerExplosion(float rpm) {
+        // Buscar voz libre; si no hay, robamos la más vieja
+        Voice* target = &voices[0];
+        for (auto& v : voices) {
+            if (!v.active) {
+                target = &v;
+                break;
+            }
+            if (v.position > target->position) target = &v;
+        }
+
+        // Tono y duración salen del tramo de RPM: a más RPM, golpes más
+        // agudos y cortos. Entre dos tramos se hace crossfade lineal.
+        float bucketPos = cache.getBucketPosition(rpm);
+        int lowBucket = static_cast<int>(bucketPos);
+        int highBucket = std::min(lowBucket + 1, cache.getBucketCount() - 1);
+        float blend = bucketPos - lowBucket;
+
+        // Variante de ruido al azar para que no se repita el mismo golpe
+        int variant = std::rand() % ImpulseCache::VARIANTS;
+
+        // Variación aleatoria de volumen (más realismo)
+        float amplitude = 0.8f + ((std::rand() % 40) / 100.f);
+
+        target->active = true;
+        target->position = 0;
+        target->low = &cache.get(lowBucket, variant);
+        target->high = &cache.get(highBucket, variant);
+        target->gainLow = amplitude * (1.f - blend);
+        target->gainHigh = amplitude * blend;
+        return *target;
+    }
+
+    const ImpulseCache& cache;
+    std::vector<Voice> voices;
+    float sampleRate;
+    std::atomic<float> currentRPM;
+    std::atomic<float> targetVolume;
+    int samplesUntilNextFire;
+};
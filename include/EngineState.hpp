@@ -0,0 +1,55 @@
+#pragma once
+#include <atomic>
+#include <cerrno>
+#include <cstdint>
+#include <signal.h>
+
+// Estado del motor compartido entre procesos (memoria compartida POSIX).
+// Protegido con un seqlock: el simulador es el único escritor y nunca
+// espera a los lectores; los lectores reintentan si leyeron a medias.
+
+namespace EngineState {
+    const char* const DEFAULT_NAME = "/motorsim_state";
+    const std::uint32_t MAGIC = 0x4D4F5452; // "MOTR"
+    const std::uint32_t VERSION = 2;
+
+    // Fases del ciclo de 4 tiempos (mismo orden que Piston::getCyclePhase)
+    enum Phase : std::uint32_t { ADMISION = 0, COMPRESION, EXPLOSION, ESCAPE };
+
+    // Copia local del estado, lo que ve el lector
+    struct Snapshot {
+        float rpm = 0.f;
+        float angle = 0.f;
+        double totalRevolutions = 0.0;
+        std::uint32_t phase = ADMISION;
+        bool redlining = false;
+        std::uint32_t sequence = 0; // Crece con cada publicación (siempre par)
+    };
+
+    // Layout del segmento. Todos los campos son atómicos lock-free para que
+    // las lecturas concurrentes estén bien definidas entre procesos.
+    struct Shared {
+        std::atomic<std::uint32_t> magic;
+        std::atomic<std::uint32_t> version;
+        std::atomic<std::uint32_t> sequence; // Impar = escritura en curso
+        std::atomic<std::int32_t> writerPid; // Proceso dueño del segmento
+
+        std::atomic<float> rpm;
+        std::atomic<float> angle;
+        std::atomic<double> totalRevolutions;
+        std::atomic<std::uint32_t> phase;
+        std::atomic<std::uint32_t> redlining;
+    };
+
+    static_assert(std::atomic<std::int32_t>::is_always_lock_free, "int32 atomico no lock-free");
+    static_assert(std::atomic<std::uint32_t>::is_always_lock_free, "uint32 atomico no lock-free");
+    static_assert(std::atomic<float>::is_always_lock_free, "float atomico no lock-free");
+    static_assert(std::atomic<double>::is_always_lock_free, "double atomico no lock-free");
+
+    // kill(pid, 0) no envía nada: solo comprueba que el proceso exista
+    // (EPERM significa que existe pero es de otro usuario)
+    inline bool isProcessAlive(std::int32_t pid) {
+        if (pid <= 0) return false;
+        return kill(pid, 0) == 0 || errno == EPERM;
+    }
+}
@@ -0,0 +1,58 @@
+#pragma once
+#include <SFML/Graphics.hpp>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <fstream>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Graba cada frame como una imagen numerada (frame_000000.ppm, ...).
+// La codificación y escritura a disco corren en un pool de hilos fijo;
+// la cola de frames pendientes es acotada y submit() bloquea cuando se
+// llena (backpressure), así la memoria no crece sin límite si el disco
+// es más lento que el render.
+class FrameRecorder {
+public:
+    enum Format { PPM, PNG };
+
+    FrameRecorder(const std::string& directory, Format format,
+                  unsigned int workerCount = 2, std::size_t maxPending = 8);
+    ~FrameRecorder(); // Espera a que se escriban todos los frames pendientes
+
+    // false si no se pudo crear el directorio o el archivo de tiempos;
+    // en ese caso no se arrancan los workers y no hay que grabar nada
+    bool isOpen() const { return ready; }
+
+    // Encola un frame con su instante de simulación (en segundos)
+    void submit(sf::Image&& image, double simTime);
+
+    std::size_t getFramesSubmitted() const { return nextIndex; }
+
+private:
+    struct Job {
+        sf::Image image;
+        std::size_t index;
+    };
+
+    void workerLoop();
+    bool writeFrame(const Job& job) const;
+    std::string framePath(std::size_t index) const;
+
+    std::string directory;
+    Format format;
+    std::size_t maxPending;
+    std::size_t nextIndex;
+
+    std::deque<Job> pending;
+    std::mutex mutex;
+    std::condition_variable notEmpty;
+    std::condition_variable notFull;
+    bool stopping;
+    bool ready;
+
+    std::vector<std::thread> workers;
+    std::ofstream timestamps; // frame -> tiempo de simulación
+};
@@ -0,0 +1,71 @@
+#pragma once
+#include <vector>
+#include <cmath>
+#include <algorithm>
+
+// Tabla de explosiones pre-renderizadas para EngineSound.
+// El tono y la caída de cada explosión dependen solo de las RPM, así que
+// se sintetizan una vez por tramo de RPM (con varias variantes de ruido
+// para que no suene repetitivo) y las voces solo leen y escalan muestras.
+class ImpulseCache {
+public:
+    static const int BUCKET_RPM = 250; // Ancho de cada tramo
+    static const int VARIANTS = 4;     // Variantes de ruido por tramo
+
+    ImpulseCache(float sampleRate = 44100.f, float maxRPM = 7500.f) {
+        bucketCount = static_cast<int>(maxRPM / BUCKET_RPM) + 1;
+        impulses.resize(bucketCount * VARIANTS);
+
+        for (int b = 0; b < bucketCount; ++b) {
+            for (int v = 0; v < VARIANTS; ++v) {
+                render(impulses[b * VARIANTS + v], b * BUCKET_RPM, sampleRate, 1 + b * VARIANTS + v);
+            }
+        }
+    }
+
+    int getBucketCount() const { return bucketCount; }
+
+    // Posición continua en la tabla: la parte entera es el tramo y la
+    // fraccionaria el peso del tramo siguiente para el crossfade
+    float getBucketPosition(float rpm) const {
+        float pos = rpm / BUCKET_RPM;
+        return std::min(std::max(pos, 0.f), static_cast<float>(bucketCount - 1));
+    }
+
+    const std::vector<float>& get(int bucket, int variant) const {
+        return impulses[bucket * VARIANTS + variant];
+    }
+
+private:
+    // Misma síntesis que hacía cada voz en tiempo real: envolvente
+    // exponencial, seno con caída de tono y ruido marrón
+    static void render(std::vector<float>& out, float rpm, float sampleRate, unsigned int seed) {
+        float toneFreq = 40.f + (rpm * 0.015f);
+        float decayRate = 15.f + (rpm * 0.02f);
+        float brownNoise = 0.f;
+
+        out.clear();
+        for (int n = 1; ; ++n) {
+            float time = n / sampleRate;
+            float envelope = std::exp(-time * decayRate);
+            if (envelope < 0.001f) break;
+
+            float instantFreq = toneFreq * (1.0f - time * 2.0f);
+            float sub = std::sin(time * instantFreq * 2.f * 3.14159f);
+
+            // Generador propio para que cada variante sea reproducible
+            seed = seed * 1664525u + 1013904223u;
+            float white = ((seed >> 16) % 100) / 50.f - 1.f;
+            brownNoise = (brownNoise + white) * 0.5f;
+
+            float voiceMix = (sub * 0.6f) + (brownNoise * 0.4f);
+            if (voiceMix > 1.0f) voiceMix = 1.0f;
+            if (voiceMix < -1.0f) voiceMix = -1.0f;
+
+            out.push_back(voiceMix * envelope);
+        }
+    }
+
+    int bucketCount;
+    std::vector<std::vector<float>> impulses;
+};
@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+#include "EngineSound.hpp"
+
+// Bus de mezcla estéreo para varios motores. Cada fuente tiene su propia
+// ganancia y paneo; el bus aplica un único limitador maestro al final.
+// No depende de SFML (AudioMixer lo conecta a un sf::SoundStream).
+class MixBus {
+public:
+    MixBus();
+
+    // Las fuentes no son propiedad del bus: deben vivir mientras estén conectadas
+    void addSource(EngineSound& source, float gain = 1.f, float pan = 0.f);
+    void removeSource(EngineSound& source);
+    void setGain(EngineSound& source, float gain);
+    void setPan(EngineSound& source, float pan); // -1 izquierda, 0 centro, 1 derecha
+    void setMasterVolume(float volume);
+
+    std::size_t getSourceCount() const;
+
+    // Mezcla 'frames' muestras estéreo intercaladas (L R L R ...) en out
+    void mix(std::int16_t* out, std::size_t frames);
+
+private:
+    struct Channel {
+        EngineSound* source;
+        float gain;
+        float pan;
+        float gainLeft;  // Derivadas de gain y pan
+        float gainRight;
+    };
+
+    static void updateGains(Channel& channel);
+    Channel* find(EngineSound& source);
+
+    mutable std::mutex mutex;
+    std::vector<Channel> channels;
+    float masterVolume;
+
+    // Buffers de trabajo (solo los usa el hilo de audio dentro de mix)
+    std::vector<float> sourceBuffer;
+    std::vector<float> left;
+    std::vector<float> right;
+};
@@ -0,0 +1,59 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+#if defined(__SSE2__) || defined(_M_X64)
+#include <emmintrin.h>
+#define MIX_KERNELS_SSE2 1
+#endif
+
+// Rutinas de mezcla de audio. Con SSE2 procesan 4 muestras (o 8 al
+// convertir a 16 bits) por instrucción; sin SSE2 caen al bucle escalar.
+namespace MixKernels {
+    // Escala: +/-1.0 nominal -> 20000 en 16 bits, con techo de seguridad
+    const float OUTPUT_SCALE = 20000.f;
+    const float LIMIT = 32000.f;
+
+    // dst[i] += src[i] * gain
+    inline void accumulate(const float* src, float gain, float* dst, std::size_t count) {
+        std::size_t i = 0;
+#ifdef MIX_KERNELS_SSE2
+        __m128 g = _mm_set1_ps(gain);
+        for (; i < (count & ~std::size_t(3)); i += 4) {
+            __m128 d = _mm_loadu_ps(dst + i);
+            d = _mm_add_ps(d, _mm_mul_ps(_mm_loadu_ps(src + i), g));
+            _mm_storeu_ps(dst + i, d);
+        }
+#endif
+        for (; i < count; ++i) dst[i] += src[i] * gain;
+    }
+
+    inline float limitScalar(float x) {
+        if (x > LIMIT) return LIMIT;
+        if (x < -LIMIT) return -LIMIT;
+        return x;
+    }
+
+    // Hard limiter + conversión a 16 bits estéreo intercalado (L R L R ...)
+    inline void interleaveToInt16(const float* left, const float* right, float scale,
+                                  std::int16_t* dst, std::size_t frames) {
+        std::size_t i = 0;
+#ifdef MIX_KERNELS_SSE2
+        __m128 s = _mm_set1_ps(scale);
+        __m128 hi = _mm_set1_ps(LIMIT);
+        __m128 lo = _mm_set1_ps(-LIMIT);
+        for (; i < (frames & ~std::size_t(3)); i += 4) {
+            __m128 l = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(left + i), s), lo), hi);
+            __m128 r = _mm_min_ps(_mm_max_ps(_mm_mul_ps(_mm_loadu_ps(right + i), s), lo), hi);
+            __m128i li = _mm_cvttps_epi32(l);
+            __m128i ri = _mm_cvttps_epi32(r);
+            __m128i packed = _mm_packs_epi32(_mm_unpacklo_epi32(li, ri), _mm_unpackhi_epi32(li, ri));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(dst + i * 2), packed);
+        }
+#endif
+        for (; i < frames; ++i) {
+            dst[i * 2] = static_cast<std::int16_t>(limitScalar(left[i] * scale));
+            dst[i * 2 + 1] = static_cast<std::int16_t>(limitScalar(right[i] * scale));
+        }
+    }
+}
@@ -40,9 +40,12 @@ private:
 public:
     Piston(float x, float y);
     void update(float angle);
-    void draw(sf::RenderWindow& window);
+    void draw(sf::RenderTarget& target);
 
     // --- NUEVOS MÉTODOS PARA QoS ---
+    // Índice de la fase: 0 Admisión, 1 Compresión, 2 Explosión, 3 Escape
+    int getCyclePhase(float angle) const;
+
     // Devuelve el nombre de la fase (Admisión, etc.) para el HUD
     std::string getCyclePhaseName(float angle) const;
     
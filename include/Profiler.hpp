@@ -0,0 +1,72 @@
+#pragma once
+#include <SFML/System.hpp>
+#include <ctime>
+#include <iostream>
+#include <iomanip>
+#include <string>
+
+// Medidor simple de tiempos de arranque. Imprime por consola cuánto tardó
+// cada etapa desde que se creó el profiler (p.ej. hasta el primer frame).
+// También reporta el uso de CPU del proceso mientras está en reposo.
+class Profiler {
+public:
+    Profiler() : idle(false), idleCpuStart(0), idleWall(0.f), idleCpu(0.f) {}
+
+    void mark(const std::string& label) {
+        float ms = clock.getElapsedTime().asMicroseconds() / 1000.f;
+        std::cout << "[perf] " << label << ": "
+                  << std::fixed << std::setprecision(2) << ms << " ms" << std::endl;
+    }
+
+    // --- REPOSO ---
+    // Los periodos de reposo se acumulan y se reportan juntos cada minuto
+    // de reposo total: los periodos cortos (un frame entre medio) solos no
+    // dan una cifra de CPU con sentido.
+    void beginIdle() {
+        idle = true;
+        idleClock.restart();
+        idleCpuStart = std::clock();
+    }
+
+    // Llamar en cada vuelta del bucle en reposo
+    void idleTick() {
+        if (idle && idleWall + idleClock.getElapsedTime().asSeconds() >= IDLE_REPORT_SECONDS) {
+            endIdle();
+            reportIdle();
+            beginIdle();
+        }
+    }
+
+    void endIdle() {
+        if (!idle) return;
+        idleWall += idleClock.getElapsedTime().asSeconds();
+        idleCpu += static_cast<float>(std::clock() - idleCpuStart) / CLOCKS_PER_SEC;
+        idle = false;
+    }
+
+    // Reporta lo acumulado que no llegó a un reporte periódico (al salir)
+    void flushIdle() {
+        endIdle();
+        if (idleWall > 0.f) reportIdle();
+    }
+
+private:
+    static constexpr float IDLE_REPORT_SECONDS = 60.f;
+
+    void reportIdle() {
+        // std::clock() es tiempo de CPU de todo el proceso (incluye el hilo de audio)
+        float percent = (idleWall > 0.f) ? 100.f * idleCpu / idleWall : 0.f;
+        std::cout << "[perf] reposo: " << std::fixed << std::setprecision(1) << idleWall << " s, CPU "
+                  << std::setprecision(2) << percent << "%" << std::endl;
+        idleWall = 0.f;
+        idleCpu = 0.f;
+    }
+
+    sf::Clock clock;
+
+    bool idle;
+    sf::Clock idleClock;
+    std::clock_t idleCpuStart;
+    float idleWall; // Segundos acumulados en reposo desde el último reporte
+    float idleCpu;  // Segundos de CPU en esos periodos
+};
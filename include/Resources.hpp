@@ -0,0 +1,12 @@
+#pragma once
+#include <cstddef>
+
+// Recursos compilados dentro del ejecutable (ver cmake/EmbedResource.cmake).
+// Así el binario arranca igual sin importar el directorio de trabajo.
+namespace Resources {
+    extern const unsigned char arial_data[];
+    extern const std::size_t arial_size;
+
+    extern const unsigned char dejavu_bold_data[];
+    extern const std::size_t dejavu_bold_size;
+}
@@ -0,0 +1,24 @@
+#pragma once
+#include <string>
+#include "EngineState.hpp"
+
+// Escritor del segmento de memoria compartida. Crea el segmento al abrir
+// y lo elimina al destruirse. publish() nunca bloquea.
+class StatePublisher {
+public:
+    StatePublisher();
+    ~StatePublisher();
+
+    StatePublisher(const StatePublisher&) = delete;
+    StatePublisher& operator=(const StatePublisher&) = delete;
+
+    bool open(const std::string& name = EngineState::DEFAULT_NAME);
+    void close();
+    bool isOpen() const { return shared != nullptr; }
+
+    void publish(const EngineState::Snapshot& state);
+
+private:
+    std::string name;
+    EngineState::Shared* shared;
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include <string>
+#include "EngineState.hpp"
+
+// Lector del segmento publicado por el simulador. Mapea el segmento en
+// solo lectura; read() copia un estado consistente sin bloquear al escritor.
+class StateReader {
+public:
+    StateReader();
+    ~StateReader();
+
+    StateReader(const StateReader&) = delete;
+    StateReader& operator=(const StateReader&) = delete;
+
+    bool open(const std::string& name = EngineState::DEFAULT_NAME);
+    void close();
+    bool isOpen() const { return shared != nullptr; }
+
+    // Devuelve false si el publicador cerró el segmento o si estuvo
+    // ocupado escribiendo en todos los intentos
+    bool read(EngineState::Snapshot& out, int maxAttempts = 1000) const;
+
+    // true mientras el publicador siga abierto y su proceso exista
+    // (hace una llamada al sistema: no usar en cada lectura a kHz)
+    bool isAlive() const;
+
+private:
+    const EngineState::Shared* shared;
+};
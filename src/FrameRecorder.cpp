@@ -0,0 +1,99 @@
+#include "FrameRecorder.hpp"
+#include <cstdio>
+#include <filesystem>
+#include <iomanip>
+#include <iostream>
+
+FrameRecorder::FrameRecorder(const std::string& directory, Format format,
+                             unsigned int workerCount, std::size_t maxPending)
+    : directory(directory), format(format), maxPending(maxPending > 0 ? maxPending : 1),
+      nextIndex(0), stopping(false), ready(false)
+{
+    std::error_code ec;
+    std::filesystem::create_directories(directory, ec);
+    if (ec) {
+        std::cerr << "Error: no se pudo crear " << directory << ": " << ec.message() << std::endl;
+        return;
+    }
+
+    timestamps.open(directory + "/timestamps.txt");
+    if (!timestamps) {
+        std::cerr << "Error: no se pudo abrir " << directory << "/timestamps.txt" << std::endl;
+        return;
+    }
+    timestamps << std::fixed << std::setprecision(6);
+    ready = true;
+
+    if (workerCount == 0) workerCount = 1;
+    for (unsigned int i = 0; i < workerCount; ++i) {
+        workers.emplace_back(&FrameRecorder::workerLoop, this);
+    }
+}
+
+FrameRecorder::~FrameRecorder() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    notEmpty.notify_all();
+    for (auto& w : workers) w.join();
+}
+
+void FrameRecorder::submit(sf::Image&& image, double simTime) {
+    std::size_t index = nextIndex++;
+    timestamps << index << " " << simTime << "\n";
+
+    std::unique_lock<std::mutex> lock(mutex);
+    // Backpressure: si los workers van atrasados, el render espera
+    notFull.wait(lock, [this] { return pending.size() < maxPending; });
+    pending.push_back(Job{ std::move(image), index });
+    lock.unlock();
+    notEmpty.notify_one();
+}
+
+void FrameRecorder::workerLoop() {
+    for (;;) {
+        std::unique_lock<std::mutex> lock(mutex);
+        notEmpty.wait(lock, [this] { return stopping || !pending.empty(); });
+        // Al cerrar se vacía la cola antes de salir
+        if (pending.empty()) return;
+
+        Job job = std::move(pending.front());
+        pending.pop_front();
+        lock.unlock();
+        notFull.notify_one();
+
+        if (!writeFrame(job)) {
+            std::cerr << "Error: no se pudo escribir " << framePath(job.index) << std::endl;
+        }
+    }
+}
+
+std::string FrameRecorder::framePath(std::size_t index) const {
+    char name[32];
+    std::snprintf(name, sizeof(name), "/frame_%06zu.%s", index, format == PNG ? "png" : "ppm");
+    return directory + name;
+}
+
+bool FrameRecorder::writeFrame(const Job& job) const {
+    if (format == PNG) return job.image.saveToFile(framePath(job.index));
+
+    // PPM binario (P6): sin compresión, lo más rápido de escribir
+    sf::Vector2u size = job.image.getSize();
+    std::ofstream out(framePath(job.index), std::ios::binary);
+    if (!out) return false;
+    out << "P6\n" << size.x << " " << size.y << "\n255\n";
+
+    const sf::Uint8* rgba = job.image.getPixelsPtr();
+    std::vector<char> row(size.x * 3);
+    for (unsigned int y = 0; y < size.y; ++y) {
+        for (unsigned int x = 0; x < size.x; ++x) {
+            const sf::Uint8* p = rgba + (y * size.x + x) * 4;
+            row[x * 3 + 0] = p[0];
+            row[x * 3 + 1] = p[1];
+            row[x * 3 + 2] = p[2];
+        }
+        out.write(row.data(), row.size());
+    }
+    return static_cast<bool>(out);
+}
@@ -0,0 +1,85 @@
+#include "MixBus.hpp"
+#include <algorithm>
+#include <cmath>
+#include "MixKernels.hpp"
+
+MixBus::MixBus() : masterVolume(1.f) {}
+
+void MixBus::updateGains(Channel& channel) {
+    // Paneo de potencia constante: el volumen percibido no cae en el centro
+    float pan = std::min(std::max(channel.pan, -1.f), 1.f);
+    float angle = (pan + 1.f) * 0.25f * 3.14159265f;
+    channel.gainLeft = channel.gain * std::cos(angle);
+    channel.gainRight = channel.gain * std::sin(angle);
+}
+
+MixBus::Channel* MixBus::find(EngineSound& source) {
+    for (auto& c : channels) {
+        if (c.source == &source) return &c;
+    }
+    return nullptr;
+}
+
+void MixBus::addSource(EngineSound& source, float gain, float pan) {
+    std::lock_guard<std::mutex> lock(mutex);
+    Channel channel;
+    channel.source = &source;
+    channel.gain = gain;
+    channel.pan = pan;
+    updateGains(channel);
+    channels.push_back(channel);
+}
+
+void MixBus::removeSource(EngineSound& source) {
+    std::lock_guard<std::mutex> lock(mutex);
+    channels.erase(std::remove_if(channels.begin(), channels.end(),
+                                  [&](const Channel& c) { return c.source == &source; }),
+                   channels.end());
+}
+
+void MixBus::setGain(EngineSound& source, float gain) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (Channel* c = find(source)) {
+        c->gain = gain;
+        updateGains(*c);
+    }
+}
+
+void MixBus::setPan(EngineSound& source, float pan) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (Channel* c = find(source)) {
+        c->pan = pan;
+        updateGains(*c);
+    }
+}
+
+void MixBus::setMasterVolume(float volume) {
+    std::lock_guard<std::mutex> lock(mutex);
+    masterVolume = volume;
+}
+
+std::size_t MixBus::getSourceCount() const {
+    std::lock_guard<std::mutex> lock(mutex);
+    return channels.size();
+}
+
+void MixBus::mix(std::int16_t* out, std::size_t frames) {
+    if (sourceBuffer.size() < frames) {
+        sourceBuffer.resize(frames);
+        left.resize(frames);
+        right.resize(frames);
+    }
+    std::fill(left.begin(), left.begin() + frames, 0.f);
+    std::fill(right.begin(), right.begin() + frames, 0.f);
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& c : channels) {
+        if (c.source->isSilent()) continue;
+        c.source->render(&sourceBuffer[0], frames);
+        MixKernels::accumulate(&sourceBuffer[0], c.gainLeft, &left[0], frames);
+        MixKernels::accumulate(&sourceBuffer[0], c.gainRight, &right[0], frames);
+    }
+
+    // Un único limitador para todo el bus
+    MixKernels::interleaveToInt16(&left[0], &right[0], masterVolume * MixKernels::OUTPUT_SCALE, out, frames);
+}
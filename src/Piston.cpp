@@ -123,12 +123,17 @@ float getCyclePhaseInternal(float angle) {
     return cyclePhase;
 }
 
-std::string Piston::getCyclePhaseName(float angle) const {
+int Piston::getCyclePhase(float angle) const {
     float p = getCyclePhaseInternal(angle);
-    if (p < M_PI) return "ADMISION";
-    if (p < 2.0 * M_PI) return "COMPRESION";
-    if (p < 3.0 * M_PI) return "EXPLOSION";
-    return "ESCAPE";
+    if (p < M_PI) return 0;
+    if (p < 2.0 * M_PI) return 1;
+    if (p < 3.0 * M_PI) return 2;
+    return 3;
+}
+
+std::string Piston::getCyclePhaseName(float angle) const {
+    static const char* names[] = { "ADMISION", "COMPRESION", "EXPLOSION", "ESCAPE" };
+    return names[getCyclePhase(angle)];
 }
 
 sf::Vector2f Piston::getExhaustPortPosition() const {
@@ -228,19 +233,19 @@ void Piston::update(float angle) {
     pistonRod.setRotation(rodAngle - 90.f); 
 }
 
-void Piston::draw(sf::RenderWindow& window) {
-    window.draw(gasChamber);
-    window.draw(sparkPlugTip);
-    window.draw(valveIntake);
-    window.draw(valveExhaust);
-    window.draw(leftBlock);
-    window.draw(rightBlock);
-    window.draw(headBlock);
-    window.draw(sparkPlugBody);
-    window.draw(pistonRod);
-    window.draw(pistonHead);
-    window.draw(wristPin);
-    window.draw(crankArm);
-    window.draw(mainBearing);
-    window.draw(crankPin);      
+void Piston::draw(sf::RenderTarget& target) {
+    target.draw(gasChamber);
+    target.draw(sparkPlugTip);
+    target.draw(valveIntake);
+    target.draw(valveExhaust);
+    target.draw(leftBlock);
+    target.draw(rightBlock);
+    target.draw(headBlock);
+    target.draw(sparkPlugBody);
+    target.draw(pistonRod);
+    target.draw(pistonHead);
+    target.draw(wristPin);
+    target.draw(crankArm);
+    target.draw(mainBearing);
+    target.draw(crankPin);      
 }
\ No newline at end of file
@@ -0,0 +1,111 @@
+#include "StatePublisher.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+// Un segmento existente es un resto abandonado si su escritor ya no
+// existe. Si todavía no tiene el tamaño completo no se puede saber quién
+// es el dueño (puede estar recién creado), así que no se toca.
+static bool isStaleSegment(const std::string& name, std::int32_t& owner) {
+    owner = 0;
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) return errno == ENOENT; // Desapareció entre medio: se puede crear
+
+    struct stat info;
+    bool fullSize = (fstat(fd, &info) == 0 &&
+                     info.st_size >= static_cast<off_t>(sizeof(EngineState::Shared)));
+    if (!fullSize) {
+        ::close(fd);
+        return false;
+    }
+
+    void* mem = mmap(nullptr, sizeof(EngineState::Shared), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) return false;
+
+    owner = static_cast<const EngineState::Shared*>(mem)->writerPid.load(std::memory_order_acquire);
+    munmap(mem, sizeof(EngineState::Shared));
+    return !EngineState::isProcessAlive(owner);
+}
+
+StatePublisher::StatePublisher() : shared(nullptr) {}
+
+StatePublisher::~StatePublisher() {
+    close();
+}
+
+bool StatePublisher::open(const std::string& segmentName) {
+    close();
+
+    // O_EXCL: el seqlock asume un único escritor, nunca se comparte el segmento
+    int fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    if (fd < 0 && errno == EEXIST) {
+        std::int32_t owner = 0;
+        if (!isStaleSegment(segmentName, owner)) {
+            if (owner > 0) {
+                std::cerr << "Error: " << segmentName << " ya lo publica el proceso " << owner << std::endl;
+            } else {
+                std::cerr << "Error: " << segmentName << " existe y no se puede verificar su dueño"
+                          << " (si no hay otro MotorSim, borrarlo de /dev/shm)" << std::endl;
+            }
+            return false;
+        }
+        // Resto de un publicador que murió sin limpiar: se reemplaza
+        shm_unlink(segmentName.c_str());
+        fd = shm_open(segmentName.c_str(), O_CREAT | O_EXCL | O_RDWR, 0644);
+    }
+    if (fd < 0) {
+        std::cerr << "Error: shm_open(" << segmentName << "): " << std::strerror(errno) << std::endl;
+        return false;
+    }
+    if (ftruncate(fd, sizeof(EngineState::Shared)) != 0) {
+        std::cerr << "Error: ftruncate(" << segmentName << "): " << std::strerror(errno) << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    void* mem = mmap(nullptr, sizeof(EngineState::Shared), PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    ::close(fd); // El mapeo sigue válido sin el descriptor
+    if (mem == MAP_FAILED) {
+        std::cerr << "Error: mmap(" << segmentName << "): " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    name = segmentName;
+    shared = static_cast<EngineState::Shared*>(mem);
+
+    // El segmento es nuevo (lleno de ceros): secuencia en 0, sin escrituras
+    shared->writerPid.store(static_cast<std::int32_t>(getpid()), std::memory_order_relaxed);
+    shared->version.store(EngineState::VERSION, std::memory_order_relaxed);
+    shared->magic.store(EngineState::MAGIC, std::memory_order_release);
+    return true;
+}
+
+void StatePublisher::close() {
+    if (!shared) return;
+    shared->magic.store(0, std::memory_order_release);
+    munmap(shared, sizeof(EngineState::Shared));
+    shm_unlink(name.c_str());
+    shared = nullptr;
+}
+
+void StatePublisher::publish(const EngineState::Snapshot& state) {
+    if (!shared) return;
+
+    // Seqlock: secuencia impar mientras se escriben los campos
+    std::uint32_t seq = shared->sequence.load(std::memory_order_relaxed);
+    shared->sequence.store(seq + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    shared->rpm.store(state.rpm, std::memory_order_relaxed);
+    shared->angle.store(state.angle, std::memory_order_relaxed);
+    shared->totalRevolutions.store(state.totalRevolutions, std::memory_order_relaxed);
+    shared->phase.store(state.phase, std::memory_order_relaxed);
+    shared->redlining.store(state.redlining ? 1u : 0u, std::memory_order_relaxed);
+
+    shared->sequence.store(seq + 2, std::memory_order_release);
+}
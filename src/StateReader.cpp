@@ -0,0 +1,90 @@
+#include "StateReader.hpp"
+#include <cerrno>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+StateReader::StateReader() : shared(nullptr) {}
+
+StateReader::~StateReader() {
+    close();
+}
+
+bool StateReader::open(const std::string& name) {
+    close();
+
+    int fd = shm_open(name.c_str(), O_RDONLY, 0);
+    if (fd < 0) {
+        std::cerr << "Error: shm_open(" << name << "): " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    // Mapear más allá del tamaño real daría SIGBUS al leer (p.ej. si el
+    // publicador todavía no hizo ftruncate)
+    struct stat info;
+    if (fstat(fd, &info) != 0 || info.st_size < static_cast<off_t>(sizeof(EngineState::Shared))) {
+        std::cerr << "Error: " << name << " no tiene el tamaño esperado" << std::endl;
+        ::close(fd);
+        return false;
+    }
+
+    void* mem = mmap(nullptr, sizeof(EngineState::Shared), PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd);
+    if (mem == MAP_FAILED) {
+        std::cerr << "Error: mmap(" << name << "): " << std::strerror(errno) << std::endl;
+        return false;
+    }
+
+    const EngineState::Shared* candidate = static_cast<const EngineState::Shared*>(mem);
+    if (candidate->magic.load(std::memory_order_acquire) != EngineState::MAGIC ||
+        candidate->version.load(std::memory_order_relaxed) != EngineState::VERSION) {
+        std::cerr << "Error: " << name << " no es un segmento de estado compatible" << std::endl;
+        munmap(mem, sizeof(EngineState::Shared));
+        return false;
+    }
+
+    shared = candidate;
+    return true;
+}
+
+void StateReader::close() {
+    if (!shared) return;
+    munmap(const_cast<EngineState::Shared*>(shared), sizeof(EngineState::Shared));
+    shared = nullptr;
+}
+
+bool StateReader::isAlive() const {
+    if (!shared) return false;
+    if (shared->magic.load(std::memory_order_acquire) != EngineState::MAGIC) return false;
+    return EngineState::isProcessAlive(shared->writerPid.load(std::memory_order_relaxed));
+}
+
+bool StateReader::read(EngineState::Snapshot& out, int maxAttempts) const {
+    if (!shared) return false;
+    // Al cerrar, el publicador borra magic: los datos ya no son en vivo
+    if (shared->magic.load(std::memory_order_acquire) != EngineState::MAGIC) return false;
+
+    for (int attempt = 0; attempt < maxAttempts; ++attempt) {
+        std::uint32_t before = shared->sequence.load(std::memory_order_acquire);
+        if (before & 1u) continue; // Escritura en curso
+
+        EngineState::Snapshot s;
+        s.rpm = shared->rpm.load(std::memory_order_relaxed);
+        s.angle = shared->angle.load(std::memory_order_relaxed);
+        s.totalRevolutions = shared->totalRevolutions.load(std::memory_order_relaxed);
+        s.phase = shared->phase.load(std::memory_order_relaxed);
+        s.redlining = shared->redlining.load(std::memory_order_relaxed) != 0;
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        std::uint32_t after = shared->sequence.load(std::memory_order_relaxed);
+        if (before == after) {
+            s.sequence = after;
+            out = s;
+            return true;
+        }
+    }
+    return false;
+}
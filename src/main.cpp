@@ -1,11 +1,19 @@
 #include <SFML/Graphics.hpp>
+#include <algorithm>
 #include <iomanip>
 #include <sstream>
 #include <vector>
 #include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <string>
 #include "Engine.hpp"
+#include "FrameRecorder.hpp"
 #include "Piston.hpp"
-#include "SoundGenerator.hpp" // <--- Importante!
+#include "Profiler.hpp"
+#include "Resources.hpp"
+#include "StatePublisher.hpp"
+#include "AudioMixer.hpp" // <--- Importante!
 
 // --- PARTÍCULAS (Mismo código de antes) ---
 struct Particle {
@@ -18,25 +26,146 @@ struct Particle {
     float angularVelocity;
 };
 
-int main() {
+// --- FUENTES ---
+// Rasteriza de antemano todos los glifos del HUD en cada tamaño usado,
+// así el primer frame no se traba generando el atlas de la fuente.
+void prewarmGlyphs(const sf::Font& font) {
+    const unsigned int sizes[] = { 50, 25, 18, 15, 14 };
+    const sf::String extra = L"ÁÉÍÓÚÑáéíóúñ¡¿";
+
+    for (unsigned int size : sizes) {
+        for (sf::Uint32 c = 32; c < 127; ++c) font.getGlyph(c, size, false);
+        for (std::size_t i = 0; i < extra.getSize(); ++i) font.getGlyph(extra[i], size, false);
+    }
+}
+
+// --- OPCIONES DE GRABACIÓN ---
+// --capture <dir>   Guarda cada frame en <dir> (dt de simulación fijo)
+// --png             Frames en PNG en lugar de PPM
+// --fps <n>         Frames por segundo simulados al grabar (def. 60)
+// --frames <n>      Cierra tras n frames (n > 0)
+// --offscreen       Renderiza a una textura sin ventana visible ni límite de FPS
+//                   (requiere --capture y --frames)
+// --rpm <n>         Arranca en modo crucero a n RPM
+// Mientras se graba se ignora el teclado: la corrida queda definida solo
+// por las opciones y es reproducible.
+// --publish         Publica el estado en memoria compartida (EngineStateReader)
+struct Options {
+    std::string captureDir;
+    bool png = false;
+    unsigned int fps = 60;
+    bool frameLimit = false;
+    long maxFrames = 0;
+    bool offscreen = false;
+    float startRPM = 0.f;
+    bool publish = false;
+};
+
+Options parseOptions(int argc, char* argv[]) {
+    Options opt;
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--capture" && hasValue) opt.captureDir = argv[++i];
+        else if (arg == "--png") opt.png = true;
+        else if (arg == "--fps" && hasValue) opt.fps = std::max(1, std::atoi(argv[++i]));
+        else if (arg == "--frames" && hasValue) {
+            opt.frameLimit = true;
+            opt.maxFrames = std::atol(argv[++i]);
+        }
+        else if (arg == "--offscreen") opt.offscreen = true;
+        else if (arg == "--rpm" && hasValue) opt.startRPM = std::atof(argv[++i]);
+        else if (arg == "--publish") opt.publish = true;
+        else std::cerr << "Opcion desconocida: " << arg << std::endl;
+    }
+    return opt;
+}
+
+bool validateOptions(const Options& opt) {
+    if (opt.frameLimit && opt.maxFrames <= 0) {
+        std::cerr << "Error: --frames debe ser mayor que 0" << std::endl;
+        return false;
+    }
+    // Sin ventana visible ni límite de frames no habría forma de cerrarlo
+    if (opt.offscreen && (opt.captureDir.empty() || !opt.frameLimit)) {
+        std::cerr << "Error: --offscreen requiere --capture y --frames" << std::endl;
+        return false;
+    }
+    return true;
+}
+
+int main(int argc, char* argv[]) {
+    Profiler profiler;
+    Options options = parseOptions(argc, argv);
+    if (!validateOptions(options)) return 1;
+    bool capturing = !options.captureDir.empty();
+
     sf::RenderWindow window(sf::VideoMode(900, 600), "Engine Simulation - Ultimate Edition");
-    window.setFramerateLimit(60);
+    window.setFramerateLimit(options.offscreen ? 0 : 60);
+
+    // --- DESTINO DE RENDER ---
+    // En modo offscreen se dibuja a una textura y la ventana queda oculta,
+    // así la grabación corre tan rápido como den la GPU y el disco.
+    sf::RenderTexture canvas;
+    if (options.offscreen) {
+        if (!canvas.create(900, 600)) {
+            std::cerr << "Error: no se pudo crear la textura de render offscreen" << std::endl;
+            return 1;
+        }
+        window.setVisible(false);
+    }
+    sf::RenderTarget& target = options.offscreen ? static_cast<sf::RenderTarget&>(canvas) : window;
+
+    std::unique_ptr<FrameRecorder> recorder;
+    sf::Texture captureTexture;
+    if (capturing) {
+        recorder.reset(new FrameRecorder(options.captureDir,
+                                         options.png ? FrameRecorder::PNG : FrameRecorder::PPM));
+        if (!recorder->isOpen()) return 1;
+        if (!options.offscreen) captureTexture.create(900, 600);
+    }
+    const float fixedDt = 1.f / options.fps;
+
+    // Al grabar el teclado no cuenta (isKeyPressed lee el estado global,
+    // incluso con la ventana oculta o sin foco)
+    auto keyDown = [capturing](sf::Keyboard::Key key) {
+        return !capturing && sf::Keyboard::isKeyPressed(key);
+    };
+
+    // --- ESTADO COMPARTIDO (dashboards locales) ---
+    StatePublisher publisher;
+    if (options.publish) publisher.open();
 
     // --- CÁMARA (VIEW) PARA EL EFECTO DE VIBRACIÓN ---
-    sf::View view = window.getDefaultView();
+    sf::View view = target.getDefaultView();
     sf::Vector2f baseCenter = view.getCenter();
 
     Engine engine;
     Piston piston(400.f, 400.f);
     
     // --- SONIDO ---
-    SoundGenerator engineSound;
-    engineSound.play(); // Arrancar el stream (sonará silencio si rpm=0)
+    // Un único stream de salida; el motor es una fuente más del bus.
+    // Ganancia sqrt(2): con paneo al centro cada canal suena como el
+    // antiguo stream mono.
+    // Al grabar no hay audio: el hilo de audio usa std::rand() y cambiaría
+    // la secuencia aleatoria del humo, la vibración y el limitador, así que
+    // dos grabaciones con las mismas opciones darían frames distintos.
+    std::unique_ptr<AudioMixer> audio;
+    EngineSound engineSound;
+    if (!capturing) {
+        audio.reset(new AudioMixer());
+        audio->bus().addSource(engineSound, 1.41421356f, 0.f);
+        audio->play(); // Arrancar el stream (sonará silencio si rpm=0)
+    }
 
+    // Fuente embebida en el binario; el archivo solo se usa como respaldo
     sf::Font font;
-    if (!font.loadFromFile("../fonts/arial.ttf")) {
-        // Manejo de error básico
+    if (!font.loadFromMemory(Resources::arial_data, Resources::arial_size) &&
+        !font.loadFromFile("../fonts/arial.ttf")) {
+        std::cerr << "Error: no se pudo cargar la fuente del HUD" << std::endl;
     }
+    prewarmGlyphs(font);
+    profiler.mark("fuentes cargadas");
 
     // --- HUD MEJORADO ---
     sf::Text rpmText;
@@ -80,20 +209,89 @@ int main() {
 
     std::vector<Particle> smokeParticles;
     sf::Clock clock;
-    sf::Clock runTimeClock; // Tiempo total corriendo
+    double runTime = 0.0; // Tiempo total corriendo
+    double simTime = 0.0; // Tiempo simulado (con slow-mo), el que se graba
+    long frameCount = 0;
     
     float timeScale = 1.0f;
+    bool firstFrame = true;
+
+    // --- MODO REPOSO ---
+    // Con el motor parado y sin teclas, no se simula ni se redibuja: el
+    // último frame queda en pantalla y el audio se pausa. SFML 2.5 no tiene
+    // waitEvent con timeout, así que se revisan eventos y teclado cada
+    // pocos ms (también funciona sin foco, igual que isKeyPressed).
+    const sf::Time idlePollInterval = sf::milliseconds(20);
+    bool idle = false;
+    bool audioPaused = false;
+
+    bool cruiseMode = false;
+    bool cLastState = false;
+    if (options.startRPM > 0.f) {
+        engine.cruise(options.startRPM);
+        cruiseMode = true;
+    }
 
     while (window.isOpen()) {
         sf::Event event;
+        bool wakeEvent = false;
         while (window.pollEvent(event)) {
             if (event.type == sf::Event::Closed) window.close();
+            // Solo despiertan los eventos que cambian algo; el mouse no.
+            // Mientras no se llama a display() el último frame sigue en
+            // pantalla, así que el resto no necesita redibujar.
+            if (event.type == sf::Event::KeyPressed ||
+                event.type == sf::Event::GainedFocus ||
+                event.type == sf::Event::Resized) {
+                wakeEvent = true;
+            }
+        }
+
+        bool inputHeld = keyDown(sf::Keyboard::E) ||
+                         keyDown(sf::Keyboard::W) ||
+                         keyDown(sf::Keyboard::Q) ||
+                         keyDown(sf::Keyboard::Space) ||
+                         keyDown(sf::Keyboard::C) ||
+                         keyDown(sf::Keyboard::S);
+
+        // Teclas, foco o resize fuerzan al menos un frame completo
+        bool canIdle = !capturing && !firstFrame && !wakeEvent && !inputHeld &&
+                       engine.getRPM() <= 0.f && smokeParticles.empty();
+
+        if (canIdle) {
+            if (!idle) {
+                idle = true;
+                if (audio && !audioPaused) {
+                    audio->pause();
+                    audioPaused = true;
+                }
+                profiler.beginIdle();
+            }
+            profiler.idleTick();
+            sf::sleep(idlePollInterval);
+            continue;
+        }
+
+        // Un frame suelto por foco o resize no reactiva el audio: solo
+        // vuelve cuando hay teclas o el motor gira
+        if (audio && audioPaused && (inputHeld || engine.getRPM() > 0.f)) {
+            audio->play();
+            audioPaused = false;
+        }
+
+        if (idle) {
+            idle = false;
+            profiler.endIdle();
+            runTime += clock.getElapsedTime().asSeconds(); // El reposo también cuenta como tiempo
+            clock.restart(); // Que el tiempo en reposo no llegue como un dt gigante
         }
 
         float dtReal = clock.restart().asSeconds();
+        // Al grabar, cada frame avanza exactamente 1/fps de simulación
+        if (capturing) dtReal = fixedDt;
         
         // Input Slow-Mo
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::S)) timeScale = 0.1f;
+        if (keyDown(sf::Keyboard::S)) timeScale = 0.1f;
         else timeScale = 1.0f;
 
         float dtSim = dtReal * timeScale;
@@ -105,7 +303,7 @@ int main() {
         if (currentRPM > 50) targetVol = 0.2f + (currentRPM / 2500.f) * 0.8f;
         
         // Si estamos acelerando (W), ruge más fuerte
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::W)) targetVol += 0.2f;
+        if (keyDown(sf::Keyboard::W)) targetVol += 0.2f;
 
         engineSound.setRPM(currentRPM);
         engineSound.setVolume(targetVol);
@@ -129,25 +327,23 @@ int main() {
         } else {
             view.setCenter(baseCenter);
         }
-        window.setView(view);
+        target.setView(view);
 
 
         // Inputs
         float throttle = 0.f;
         float brake = 0.f;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::E)) throttle = 6.f; 
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Q)) brake = 6000.f;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::W)) throttle += 1.f;
-        if (sf::Keyboard::isKeyPressed(sf::Keyboard::Space)) brake += 400.f;
+        if (keyDown(sf::Keyboard::E)) throttle = 6.f; 
+        if (keyDown(sf::Keyboard::Q)) brake = 6000.f;
+        if (keyDown(sf::Keyboard::W)) throttle += 1.f;
+        if (keyDown(sf::Keyboard::Space)) brake += 400.f;
 
         engine.accelerate(throttle);
         engine.deaccelerate(brake);
 
         if (throttle == 0 && brake == 0) engine.deaccelerate(20.f);
 
-        static bool cruiseMode = false;
-        static bool cLastState = false;
-        bool cState = sf::Keyboard::isKeyPressed(sf::Keyboard::C);
+        bool cState = keyDown(sf::Keyboard::C);
         if (cState && !cLastState) {
             cruiseMode = !cruiseMode;
             if(cruiseMode) engine.cruise(currentRPM);
@@ -159,6 +355,16 @@ int main() {
         engine.update(dtSim);
         piston.update(engine.getAngle());
 
+        if (publisher.isOpen()) {
+            EngineState::Snapshot state;
+            state.rpm = engine.getRPM();
+            state.angle = engine.getAngle();
+            state.totalRevolutions = engine.getTotalRevolutions();
+            state.phase = piston.getCyclePhase(engine.getAngle());
+            state.redlining = engine.isRedlining();
+            publisher.publish(state);
+        }
+
         // --- PARTICULAS ---
         if (piston.isExhaustPhase(engine.getAngle()) && currentRPM > 50.f) {
             // Más partículas a más RPM
@@ -210,7 +416,7 @@ int main() {
 
         std::stringstream ssStats;
         ssStats << "ODOMETRO: " << std::fixed << std::setprecision(1) << engine.getTotalRevolutions() << " revs\n"
-                << "TIEMPO: " << (int)runTimeClock.getElapsedTime().asSeconds() << " s";
+                << "TIEMPO: " << (int)runTime << " s";
         statsText.setString(ssStats.str());
         
         phaseText.setString(piston.getCyclePhaseName(engine.getAngle()));
@@ -227,7 +433,7 @@ int main() {
         else rpmBarFill.setFillColor(sf::Color::Red);
 
         // --- RENDER ---
-        window.clear(sf::Color(20, 20, 25)); // Fondo aún más técnico
+        target.clear(sf::Color(20, 20, 25)); // Fondo aún más técnico
         
         for (const auto& p : smokeParticles) {
             sf::RectangleShape shape(sf::Vector2f(p.size, p.size));
@@ -236,25 +442,55 @@ int main() {
             shape.setRotation(p.rotation);
             float alpha = (p.lifetime / p.maxLifetime) * 100;
             shape.setFillColor(sf::Color(150, 150, 150, (sf::Uint8)alpha));
-            window.draw(shape);
+            target.draw(shape);
         }
 
-        piston.draw(window);
+        piston.draw(target);
 
         // Dibujar HUD (asegurarse de que la vista del HUD no vibre)
-        window.setView(window.getDefaultView()); // Restaurar vista quieta para el texto
-        window.draw(rpmText);
-        window.draw(sf::Text("RPM", font, 15)); // Etiqueta pequeña
-        window.draw(rpmBarBack);
-        window.draw(rpmBarFill);
-        window.draw(statsText);
-        window.draw(phaseText);
-        window.draw(controlsText);
+        target.setView(target.getDefaultView()); // Restaurar vista quieta para el texto
+        target.draw(rpmText);
+        target.draw(sf::Text("RPM", font, 15)); // Etiqueta pequeña
+        target.draw(rpmBarBack);
+        target.draw(rpmBarFill);
+        target.draw(statsText);
+        target.draw(phaseText);
+        target.draw(controlsText);
         
         // Restaurar vista vibratoria para el siguiente frame del motor
-        window.setView(view); 
+        target.setView(view); 
+
+        // --- GRABACIÓN ---
+        // Se copia el frame antes de presentarlo; codificar y escribir
+        // queda a cargo de los workers del recorder.
+        // El frame muestra el estado tras avanzar dtSim: ese es su instante.
+        simTime += dtSim;
+        if (options.offscreen) {
+            canvas.display();
+            if (recorder) recorder->submit(canvas.getTexture().copyToImage(), simTime);
+        } else {
+            if (recorder) {
+                captureTexture.update(window);
+                recorder->submit(captureTexture.copyToImage(), simTime);
+            }
+            window.display();
+        }
+        runTime += dtReal;
+        ++frameCount;
+        if (options.frameLimit && frameCount >= options.maxFrames) window.close();
+
+        if (firstFrame) {
+            profiler.mark("primer frame");
+            firstFrame = false;
+        }
+    }
+
+    profiler.flushIdle();
 
-        window.display();
+    if (recorder) {
+        recorder.reset(); // Espera a que terminen de escribirse los frames
+        std::cout << "Grabados " << frameCount << " frames en " << options.captureDir << std::endl;
+        profiler.mark("grabacion completa");
     }
 
     return 0;
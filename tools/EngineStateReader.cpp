@@ -0,0 +1,80 @@
+// Lector por consola del estado publicado por MotorSim (--publish).
+// Uso: EngineStateReader [--name <segmento>] [--hz <n>] [--count <n>]
+#include <chrono>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include "StateReader.hpp"
+
+static const char* phaseName(std::uint32_t phase) {
+    switch (phase) {
+        case EngineState::ADMISION:   return "ADMISION";
+        case EngineState::COMPRESION: return "COMPRESION";
+        case EngineState::EXPLOSION:  return "EXPLOSION";
+        case EngineState::ESCAPE:     return "ESCAPE";
+    }
+    return "?";
+}
+
+int main(int argc, char* argv[]) {
+    std::string name = EngineState::DEFAULT_NAME;
+    double hz = 10.0;
+    long count = -1;
+
+    for (int i = 1; i < argc; ++i) {
+        std::string arg = argv[i];
+        bool hasValue = (i + 1 < argc);
+        if (arg == "--name" && hasValue) name = argv[++i];
+        else if (arg == "--hz" && hasValue) hz = std::atof(argv[++i]);
+        else if (arg == "--count" && hasValue) count = std::atol(argv[++i]);
+        else {
+            std::cerr << "Uso: " << argv[0] << " [--name <segmento>] [--hz <n>] [--count <n>]" << std::endl;
+            return 1;
+        }
+    }
+    if (hz <= 0.0) hz = 10.0;
+
+    StateReader reader;
+    if (!reader.open(name)) return 1;
+
+    const auto period = std::chrono::duration<double>(1.0 / hz);
+    auto next = std::chrono::steady_clock::now();
+    std::cout << std::fixed;
+
+    // isAlive() es una llamada al sistema: se consulta solo cuando una
+    // lectura falla o una vez por segundo (detecta un publicador caído
+    // que no llegó a cerrar el segmento)
+    const auto aliveCheckPeriod = std::chrono::seconds(1);
+    auto nextAliveCheck = next + aliveCheckPeriod;
+
+    for (long n = 0; count < 0 || n < count; ++n) {
+        EngineState::Snapshot s;
+        bool ok = reader.read(s);
+
+        auto now = std::chrono::steady_clock::now();
+        if (!ok || now >= nextAliveCheck) {
+            if (!reader.isAlive()) {
+                std::cerr << "El publicador de " << name << " se cerró" << std::endl;
+                return 1;
+            }
+            nextAliveCheck = now + aliveCheckPeriod;
+        }
+
+        if (ok) {
+            std::cout << "seq " << s.sequence
+                      << "  rpm " << std::setprecision(0) << std::setw(5) << s.rpm
+                      << "  angle " << std::setprecision(3) << s.angle
+                      << "  revs " << std::setprecision(1) << s.totalRevolutions
+                      << "  " << phaseName(s.phase)
+                      << (s.redlining ? "  REDLINE" : "") << std::endl;
+        } else {
+            std::cerr << "Lectura inconsistente, reintentando" << std::endl;
+        }
+
+        next += std::chrono::duration_cast<std::chrono::steady_clock::duration>(period);
+        std::this_thread::sleep_until(next);
+    }
+    return 0;
+}